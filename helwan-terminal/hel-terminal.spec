@@ -13,6 +13,7 @@ BuildRequires:  ninja-build
 BuildRequires:  gtk3-devel
 BuildRequires:  vte291-devel
 BuildRequires:  glib2-devel
+BuildRequires:  python3
 
 Requires:       gtk3
 Requires:       vte291
@@ -42,6 +43,7 @@ DESTDIR=%{buildroot} meson install -C builddir
 %{_datadir}/glib-2.0/schemas/helwan-terminal.gschema.xml
 %{_datadir}/icons/hicolor/64x64/apps/helwan-terminal.png
 %{_datadir}/helwan-terminal/helwan-commands.sh
+%{_datadir}/helwan-terminal/helwan-commands.catalog
 
 %post
 if [ -x /usr/bin/glib-compile-schemas ]; then
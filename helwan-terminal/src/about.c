@@ -12,8 +12,11 @@ void on_about_button_clicked(GtkButton *button, HelwanTerminalWindow *window) {
         "comments", "A powerful terminal emulator developed at Helwan Linux.\n\n"
                     "• Copy/Paste: Ctrl + Shift + C / V\n"
                     "• Zoom: Ctrl + + / - / 0\n"
-                    "• Settings: Click the settings icon in the top bar\n"
-                    "• New Tab: Click the plus icon to start a new session",
+                    "• Command Palette: Ctrl + Shift + P\n"
+                    "• Settings: Click the settings icon in the top bar or Ctrl + ,\n"
+                    "• New Tab: Click the plus icon or Ctrl + Shift + T\n"
+                    "• Switch Tabs: Ctrl + Page Up / Page Down\n"
+                    "• Shortcuts can be changed with gsettings (keybinding-*)",
         "website", "https://github.com/helwan-linux/helwan-terminal",
         "authors", (const char *[]){"Saeed Badreldin", NULL},
         "license-type", GTK_LICENSE_GPL_3_0,
@@ -29,6 +32,8 @@ void on_help_button_clicked(GtkButton *button, HelwanTerminalWindow *window) {
         "Helwan Terminal Help",
         GTK_WINDOW(window),
         GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
+        "Command Palette",
+        GTK_RESPONSE_ACCEPT,
         "OK",
         GTK_RESPONSE_OK,
         NULL
@@ -40,19 +45,19 @@ void on_help_button_clicked(GtkButton *button, HelwanTerminalWindow *window) {
         "لإظهار قائمة الأوامر، اكتب: مساعدة\n"
         "To show the commands list, type: help\n"
         "Para mostrar la lista de comandos, escribe: ayuda\n"
-        "要显示命令列表，请输入：帮助"
-    );
-
-    GtkWidget *link = gtk_link_button_new_with_label(
-        "https://github.com/helwan-linux/helwan-terminal/blob/main/arch_terminal_commands.md",
-        "Open Commands Guide"
+        "要显示命令列表，请输入：帮助\n\n"
+        "Command Palette: Ctrl + Shift + P"
     );
 
     gtk_box_pack_start(GTK_BOX(box), label, TRUE, TRUE, 10);
-    gtk_box_pack_start(GTK_BOX(box), link, TRUE, TRUE, 10);
 
     gtk_widget_show_all(dialog);
 
-    gtk_dialog_run(GTK_DIALOG(dialog));
+    gint response = gtk_dialog_run(GTK_DIALOG(dialog));
     gtk_widget_destroy(dialog);
+
+    // لوحة الأوامر تعمل بدون إنترنت بدلاً من رابط دليل الأوامر على GitHub
+    if (response == GTK_RESPONSE_ACCEPT) {
+        show_command_palette(window);
+    }
 }
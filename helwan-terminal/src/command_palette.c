@@ -0,0 +1,441 @@
+#include "terminal_window.h"
+#include <gtk/gtk.h>
+#include <vte/vte.h>
+#include <string.h>
+#include <stdlib.h>
+
+// HELWAN_DATADIR يأتي من meson.build حسب prefix و datadir
+#ifndef HELWAN_DATADIR
+#define HELWAN_DATADIR "/usr/share"
+#endif
+
+// فهرس الأوامر الذي يولّده tools/generate_command_catalog.py أثناء البناء
+#define COMMAND_CATALOG_FILE HELWAN_DATADIR "/helwan-terminal/helwan-commands.catalog"
+#define COMMAND_CATALOG_MAGIC "HWCC"
+#define COMMAND_CATALOG_VERSION 1
+#define COMMAND_CATALOG_HEADER_SIZE 16
+
+// أقصى عدد نتائج يُعرض في القائمة مهما كبر الفهرس
+#define PALETTE_MAX_RESULTS 50
+
+// ترتيب الحقول في كل سجل داخل الفهرس
+enum {
+    FIELD_NAME,
+    FIELD_EN,
+    FIELD_AR,
+    FIELD_ES,
+    FIELD_ZH,
+    FIELD_DESCRIPTION,
+    FIELD_CALL,
+    N_FIELDS
+};
+
+enum {
+    COLUMN_COMMAND,
+    COLUMN_DESCRIPTION,
+    COLUMN_CALL,
+    N_COLUMNS
+};
+
+typedef struct {
+    GMappedFile *file;
+    guint32 n_entries;
+    const guint32 *entries;
+    const char *strings;
+    gsize strings_size;
+} CommandCatalog;
+
+typedef struct {
+    gint score;
+    guint32 entry;
+    gint field;
+} PaletteMatch;
+
+typedef struct {
+    HelwanTerminalWindow *window;
+    GtkWidget *popup;
+    GtkWidget *entry;
+    GtkWidget *tree_view;
+    GtkListStore *store;
+} CommandPalette;
+
+// الفهرس يُحمّل مرة واحدة ويبقى مربوطاً بالذاكرة طوال عمر البرنامج
+static CommandCatalog *catalog = NULL;
+static gboolean catalog_load_failed = FALSE;
+
+static guint32 read_u32(const guint8 *p) {
+    guint32 value;
+    memcpy(&value, p, sizeof(value));
+    return GUINT32_FROM_LE(value);
+}
+
+static const char *catalog_string(const CommandCatalog *cat, guint32 entry, gint field) {
+    guint32 offset = GUINT32_FROM_LE(cat->entries[entry * N_FIELDS + field]);
+    if (offset >= cat->strings_size) {
+        return "";
+    }
+    return cat->strings + offset;
+}
+
+// ربط ملف الفهرس بالذاكرة عبر mmap والتحقق من ترويسته
+static CommandCatalog *load_command_catalog(void) {
+    if (catalog || catalog_load_failed) {
+        return catalog;
+    }
+
+    GError *error = NULL;
+    GMappedFile *file = g_mapped_file_new(COMMAND_CATALOG_FILE, FALSE, &error);
+    if (!file) {
+        g_warning("Could not load command catalog: %s", error->message);
+        g_error_free(error);
+        catalog_load_failed = TRUE;
+        return NULL;
+    }
+
+    const guint8 *data = (const guint8 *)g_mapped_file_get_contents(file);
+    gsize size = g_mapped_file_get_length(file);
+
+    if (size < COMMAND_CATALOG_HEADER_SIZE ||
+        memcmp(data, COMMAND_CATALOG_MAGIC, 4) != 0 ||
+        read_u32(data + 4) != COMMAND_CATALOG_VERSION) {
+        g_warning("Command catalog %s is invalid.", COMMAND_CATALOG_FILE);
+        g_mapped_file_unref(file);
+        catalog_load_failed = TRUE;
+        return NULL;
+    }
+
+    guint32 n_entries = read_u32(data + 8);
+    guint64 strings_offset = read_u32(data + 12);
+    guint64 table_end = COMMAND_CATALOG_HEADER_SIZE + (guint64)n_entries * N_FIELDS * sizeof(guint32);
+
+    if (strings_offset != table_end || strings_offset >= size || data[size - 1] != '\0') {
+        g_warning("Command catalog %s is truncated.", COMMAND_CATALOG_FILE);
+        g_mapped_file_unref(file);
+        catalog_load_failed = TRUE;
+        return NULL;
+    }
+
+    catalog = g_new0(CommandCatalog, 1);
+    catalog->file = file;
+    catalog->n_entries = n_entries;
+    catalog->entries = (const guint32 *)(data + COMMAND_CATALOG_HEADER_SIZE);
+    catalog->strings = (const char *)data + strings_offset;
+    catalog->strings_size = size - strings_offset;
+
+    return catalog;
+}
+
+// مطابقة تقريبية: كل حروف البحث يجب أن تظهر بالترتيب داخل اسم الأمر،
+// مع مكافأة الحروف المتتالية وبدايات الكلمات. ترجع FALSE لو لم يتطابق،
+// والدرجة (قد تكون سالبة للأسماء الطويلة) تُستخدم للترتيب فقط.
+static gboolean fuzzy_score(const gunichar *query, glong query_len, const char *candidate, gint *out_score) {
+    if (*candidate == '\0') {
+        return FALSE;
+    }
+
+    gint score = 0;
+    glong matched = 0;
+    glong length = 0;
+    gboolean previous_matched = FALSE;
+    gunichar previous = 0;
+
+    for (const char *p = candidate; *p; p = g_utf8_next_char(p), length++) {
+        gunichar c = g_unichar_tolower(g_utf8_get_char(p));
+
+        if (matched < query_len && c == query[matched]) {
+            score += 1;
+            if (previous_matched) {
+                score += 5;
+            }
+            if (length == 0 || previous == '_') {
+                score += 8;
+            }
+            matched++;
+            previous_matched = TRUE;
+        } else {
+            previous_matched = FALSE;
+        }
+        previous = c;
+    }
+
+    if (matched < query_len) {
+        return FALSE;
+    }
+
+    // تفضيل الأسماء الأقصر عند تساوي المطابقة
+    *out_score = score * 4 - (gint)(length - query_len);
+    return TRUE;
+}
+
+// إدراج نتيجة في قائمة أفضل النتائج المرتبة تنازلياً
+static void insert_match(PaletteMatch *matches, gint *n_matches, PaletteMatch match) {
+    gint pos = *n_matches;
+    if (pos == PALETTE_MAX_RESULTS) {
+        if (match.score <= matches[pos - 1].score) {
+            return;
+        }
+        pos--;
+    } else {
+        (*n_matches)++;
+    }
+
+    while (pos > 0 && matches[pos - 1].score < match.score) {
+        matches[pos] = matches[pos - 1];
+        pos--;
+    }
+    matches[pos] = match;
+}
+
+// أول اسم غير فارغ للأمر، لأن بعض الأوامر ليس لها اسم إنجليزي
+static gint first_alias_field(guint32 entry) {
+    for (gint field = FIELD_EN; field <= FIELD_ZH; field++) {
+        if (*catalog_string(catalog, entry, field) != '\0') {
+            return field;
+        }
+    }
+    return FIELD_EN;
+}
+
+static void append_result(CommandPalette *palette, guint32 entry, gint field) {
+    GtkTreeIter iter;
+    gtk_list_store_append(palette->store, &iter);
+    gtk_list_store_set(palette->store, &iter,
+                       COLUMN_COMMAND, catalog_string(catalog, entry, field),
+                       COLUMN_DESCRIPTION, catalog_string(catalog, entry, FIELD_DESCRIPTION),
+                       COLUMN_CALL, catalog_string(catalog, entry, FIELD_CALL),
+                       -1);
+}
+
+// إعادة حساب النتائج مع كل حرف يكتبه المستخدم
+static void update_results(CommandPalette *palette) {
+    gtk_list_store_clear(palette->store);
+
+    const char *text = gtk_entry_get_text(GTK_ENTRY(palette->entry));
+    glong query_len = 0;
+    gunichar *query = g_utf8_to_ucs4_fast(text, -1, &query_len);
+    for (glong i = 0; i < query_len; i++) {
+        query[i] = query[i] == ' ' ? '_' : g_unichar_tolower(query[i]);
+    }
+
+    if (query_len == 0) {
+        for (guint32 i = 0; i < catalog->n_entries && i < PALETTE_MAX_RESULTS; i++) {
+            append_result(palette, i, first_alias_field(i));
+        }
+    } else {
+        PaletteMatch matches[PALETTE_MAX_RESULTS];
+        gint n_matches = 0;
+
+        for (guint32 i = 0; i < catalog->n_entries; i++) {
+            PaletteMatch best = { G_MININT, i, FIELD_EN };
+            gboolean found = FALSE;
+            for (gint field = FIELD_EN; field <= FIELD_ZH; field++) {
+                gint score;
+                if (fuzzy_score(query, query_len, catalog_string(catalog, i, field), &score) &&
+                    (!found || score > best.score)) {
+                    best.score = score;
+                    best.field = field;
+                    found = TRUE;
+                }
+            }
+            if (found) {
+                insert_match(matches, &n_matches, best);
+            }
+        }
+
+        for (gint i = 0; i < n_matches; i++) {
+            append_result(palette, matches[i].entry, matches[i].field);
+        }
+    }
+    g_free(query);
+
+    GtkTreeIter first;
+    if (gtk_tree_model_get_iter_first(GTK_TREE_MODEL(palette->store), &first)) {
+        GtkTreeSelection *selection = gtk_tree_view_get_selection(GTK_TREE_VIEW(palette->tree_view));
+        gtk_tree_selection_select_iter(selection, &first);
+    }
+}
+
+// إدراج الأمر المختار في التبويب النشط بدون تنفيذه
+static void activate_selected(CommandPalette *palette) {
+    GtkTreeSelection *selection = gtk_tree_view_get_selection(GTK_TREE_VIEW(palette->tree_view));
+    GtkTreeModel *model = NULL;
+    GtkTreeIter iter;
+
+    if (!gtk_tree_selection_get_selected(selection, &model, &iter)) {
+        return;
+    }
+
+    gchar *command = NULL;
+    gchar *call = NULL;
+    gtk_tree_model_get(model, &iter, COLUMN_COMMAND, &command, COLUMN_CALL, &call, -1);
+
+    GtkNotebook *notebook = GTK_NOTEBOOK(palette->window->notebook);
+    GtkWidget *vte_widget = gtk_notebook_get_nth_page(notebook, gtk_notebook_get_current_page(notebook));
+
+    if (vte_widget && VTE_IS_TERMINAL(vte_widget)) {
+        // الأوامر التي تأخذ معاملات تُترك بمسافة بعدها ليكمل المستخدم
+        gchar *text = (call && strstr(call, "$@")) ? g_strconcat(command, " ", NULL) : g_strdup(command);
+        vte_terminal_feed_child(VTE_TERMINAL(vte_widget), text, -1);
+        g_free(text);
+    }
+
+    g_free(command);
+    g_free(call);
+
+    gtk_widget_destroy(palette->popup);
+    if (vte_widget) {
+        gtk_widget_grab_focus(vte_widget);
+    }
+}
+
+static void move_selection(CommandPalette *palette, gboolean down) {
+    GtkTreeSelection *selection = gtk_tree_view_get_selection(GTK_TREE_VIEW(palette->tree_view));
+    GtkTreeModel *model = NULL;
+    GtkTreeIter iter;
+
+    if (!gtk_tree_selection_get_selected(selection, &model, &iter)) {
+        return;
+    }
+
+    gboolean moved = down ? gtk_tree_model_iter_next(model, &iter)
+                          : gtk_tree_model_iter_previous(model, &iter);
+    if (moved) {
+        gtk_tree_selection_select_iter(selection, &iter);
+        GtkTreePath *path = gtk_tree_model_get_path(model, &iter);
+        gtk_tree_view_scroll_to_cell(GTK_TREE_VIEW(palette->tree_view), path, NULL, FALSE, 0, 0);
+        gtk_tree_path_free(path);
+    }
+}
+
+static void on_palette_entry_changed(GtkEditable *editable, CommandPalette *palette) {
+    (void)editable;
+    update_results(palette);
+}
+
+static void on_palette_entry_activate(GtkEntry *entry, CommandPalette *palette) {
+    (void)entry;
+    activate_selected(palette);
+}
+
+static void on_palette_row_activated(GtkTreeView *tree_view, GtkTreePath *path,
+                                     GtkTreeViewColumn *column, CommandPalette *palette) {
+    (void)tree_view;
+    (void)path;
+    (void)column;
+    activate_selected(palette);
+}
+
+static gboolean on_palette_key_press(GtkWidget *widget, GdkEventKey *event, CommandPalette *palette) {
+    (void)widget;
+
+    if (event->keyval == GDK_KEY_Escape) {
+        gtk_widget_destroy(palette->popup);
+        return TRUE;
+    } else if (event->keyval == GDK_KEY_Down) {
+        move_selection(palette, TRUE);
+        return TRUE;
+    } else if (event->keyval == GDK_KEY_Up) {
+        move_selection(palette, FALSE);
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+static gboolean on_palette_focus_out(GtkWidget *widget, GdkEventFocus *event, CommandPalette *palette) {
+    (void)widget;
+    (void)event;
+    gtk_widget_destroy(palette->popup);
+    return FALSE;
+}
+
+static void command_palette_free(CommandPalette *palette) {
+    g_object_unref(palette->store);
+    g_free(palette);
+}
+
+// رسالة للمستخدم لو الفهرس غير موجود أو تالف، مع رابط دليل الأوامر كبديل
+static void show_catalog_unavailable_dialog(HelwanTerminalWindow *window) {
+    GtkWidget *dialog = gtk_message_dialog_new(GTK_WINDOW(window),
+                                               GTK_DIALOG_MODAL | GTK_DIALOG_DESTROY_WITH_PARENT,
+                                               GTK_MESSAGE_WARNING,
+                                               GTK_BUTTONS_OK,
+                                               "The command catalog is unavailable");
+    gtk_message_dialog_format_secondary_markup(GTK_MESSAGE_DIALOG(dialog),
+        "Could not load <tt>%s</tt>.\n"
+        "Type <b>help</b> in the terminal, or open the "
+        "<a href=\"https://github.com/helwan-linux/helwan-terminal/blob/main/arch_terminal_commands.md\">"
+        "Commands Guide</a>.",
+        COMMAND_CATALOG_FILE);
+
+    gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
+}
+
+// فتح لوحة الأوامر (Ctrl+Shift+P)
+void show_command_palette(HelwanTerminalWindow *window) {
+    if (!load_command_catalog()) {
+        show_catalog_unavailable_dialog(window);
+        return;
+    }
+
+    CommandPalette *palette = g_new0(CommandPalette, 1);
+    palette->window = window;
+    palette->store = gtk_list_store_new(N_COLUMNS, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING);
+
+    palette->popup = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+    gtk_window_set_transient_for(GTK_WINDOW(palette->popup), GTK_WINDOW(window));
+    gtk_window_set_modal(GTK_WINDOW(palette->popup), TRUE);
+    gtk_window_set_decorated(GTK_WINDOW(palette->popup), FALSE);
+    gtk_window_set_type_hint(GTK_WINDOW(palette->popup), GDK_WINDOW_TYPE_HINT_DIALOG);
+    gtk_window_set_position(GTK_WINDOW(palette->popup), GTK_WIN_POS_CENTER_ON_PARENT);
+    gtk_window_set_default_size(GTK_WINDOW(palette->popup), 640, 360);
+    g_object_set_data_full(G_OBJECT(palette->popup), "command-palette", palette,
+                           (GDestroyNotify)command_palette_free);
+
+    GtkWidget *vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 6);
+    gtk_container_set_border_width(GTK_CONTAINER(vbox), 6);
+    gtk_container_add(GTK_CONTAINER(palette->popup), vbox);
+
+    palette->entry = gtk_search_entry_new();
+    gtk_entry_set_placeholder_text(GTK_ENTRY(palette->entry), "install / تثبيت / instalar / 安装");
+    gtk_box_pack_start(GTK_BOX(vbox), palette->entry, FALSE, FALSE, 0);
+
+    GtkWidget *scrolled = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled), GTK_POLICY_NEVER, GTK_POLICY_AUTOMATIC);
+    gtk_box_pack_start(GTK_BOX(vbox), scrolled, TRUE, TRUE, 0);
+
+    palette->tree_view = gtk_tree_view_new_with_model(GTK_TREE_MODEL(palette->store));
+    gtk_tree_view_set_headers_visible(GTK_TREE_VIEW(palette->tree_view), FALSE);
+    gtk_tree_view_set_enable_search(GTK_TREE_VIEW(palette->tree_view), FALSE);
+    gtk_widget_set_can_focus(palette->tree_view, FALSE);
+    gtk_container_add(GTK_CONTAINER(scrolled), palette->tree_view);
+
+    GtkCellRenderer *command_renderer = gtk_cell_renderer_text_new();
+    g_object_set(command_renderer, "weight", PANGO_WEIGHT_BOLD, NULL);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(palette->tree_view),
+        gtk_tree_view_column_new_with_attributes("Command", command_renderer, "text", COLUMN_COMMAND, NULL));
+
+    GtkCellRenderer *description_renderer = gtk_cell_renderer_text_new();
+    g_object_set(description_renderer, "ellipsize", PANGO_ELLIPSIZE_END, NULL);
+    GtkTreeViewColumn *description_column =
+        gtk_tree_view_column_new_with_attributes("Description", description_renderer, "text", COLUMN_DESCRIPTION, NULL);
+    gtk_tree_view_column_set_expand(description_column, TRUE);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(palette->tree_view), description_column);
+
+    GtkCellRenderer *call_renderer = gtk_cell_renderer_text_new();
+    g_object_set(call_renderer, "family", "monospace", "foreground", "gray", NULL);
+    gtk_tree_view_append_column(GTK_TREE_VIEW(palette->tree_view),
+        gtk_tree_view_column_new_with_attributes("Call", call_renderer, "text", COLUMN_CALL, NULL));
+
+    g_signal_connect(palette->entry, "changed", G_CALLBACK(on_palette_entry_changed), palette);
+    g_signal_connect(palette->entry, "activate", G_CALLBACK(on_palette_entry_activate), palette);
+    g_signal_connect(palette->entry, "key-press-event", G_CALLBACK(on_palette_key_press), palette);
+    g_signal_connect(palette->tree_view, "row-activated", G_CALLBACK(on_palette_row_activated), palette);
+    g_signal_connect(palette->popup, "focus-out-event", G_CALLBACK(on_palette_focus_out), palette);
+
+    update_results(palette);
+
+    gtk_widget_show_all(palette->popup);
+    gtk_widget_grab_focus(palette->entry);
+}
@@ -10,42 +10,71 @@
 extern GSettings *settings;
 extern gchar *cached_font_string;
 
+// الانتقال للتبويب التالي أو السابق مع الالتفاف عند الأطراف
+static void switch_tab(HelwanTerminalWindow *window, gint offset) {
+    GtkNotebook *notebook = GTK_NOTEBOOK(window->notebook);
+    gint n_pages = gtk_notebook_get_n_pages(notebook);
+    if (n_pages < 2) {
+        return;
+    }
+
+    gint current = gtk_notebook_get_current_page(notebook);
+    gtk_notebook_set_current_page(notebook, (current + offset + n_pages) % n_pages);
+}
+
 // دالة التعامل مع ضغطات لوحة المفاتيح
-gboolean on_terminal_key_press(GtkWidget *widget, GdkEventKey *event, HelwanTerminalWindow *window) {
-    (void)window;
-
-    // Ctrl+Shift+C (Copy)
-    if ((event->state & (GDK_CONTROL_MASK | GDK_SHIFT_MASK)) == (GDK_CONTROL_MASK | GDK_SHIFT_MASK) &&
-        event->keyval == GDK_KEY_C) {
-        vte_terminal_copy_clipboard_format(VTE_TERMINAL(widget), VTE_FORMAT_TEXT);
-        return TRUE;
+// الاختصارات نفسها معرّفة في GSettings وتُبنى في جدول داخل keybindings.c
+gboolean on_terminal_key_press(GtkWidget *widget, GdkEventKey *event, gpointer user_data) {
+    (void)user_data;
+
+    HelwanAction action = helwan_keybindings_lookup(event);
+    if (action == HELWAN_ACTION_NONE) {
+        return FALSE;
     }
-    // Ctrl+Shift+V (Paste)
-    else if ((event->state & (GDK_CONTROL_MASK | GDK_SHIFT_MASK)) == (GDK_CONTROL_MASK | GDK_SHIFT_MASK) &&
-             event->keyval == GDK_KEY_V) {
+
+    HelwanTerminalWindow *window = HELWAN_TERMINAL_WINDOW(gtk_widget_get_toplevel(widget));
+    VteTerminal *terminal = VTE_TERMINAL(widget);
+
+    switch (action) {
+    case HELWAN_ACTION_COPY:
+        vte_terminal_copy_clipboard_format(terminal, VTE_FORMAT_TEXT);
+        break;
+    case HELWAN_ACTION_PASTE: {
         GtkClipboard *clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
         gchar *text = gtk_clipboard_wait_for_text(clipboard);
         if (text) {
-            vte_terminal_paste_text(VTE_TERMINAL(widget), text);
+            vte_terminal_paste_text(terminal, text);
             g_free(text);
         }
-        return TRUE;
-    }
-    // Ctrl++ أو Ctrl+= (Zoom In)
-    else if ((event->state & GDK_CONTROL_MASK) && (event->keyval == GDK_KEY_plus || event->keyval == GDK_KEY_equal)) {
-        increase_font_size(VTE_TERMINAL(widget));
-        return TRUE;
-    }
-    // Ctrl+- أو Ctrl+_ (Zoom Out)
-    else if ((event->state & GDK_CONTROL_MASK) && (event->keyval == GDK_KEY_minus || event->keyval == GDK_KEY_underscore)) {
-        decrease_font_size(VTE_TERMINAL(widget));
-        return TRUE;
+        break;
     }
-    // Ctrl+0 (Reset Zoom)
-    else if ((event->state & GDK_CONTROL_MASK) && event->keyval == GDK_KEY_0) {
-        reset_font_size(VTE_TERMINAL(widget));
-        return TRUE;
+    case HELWAN_ACTION_ZOOM_IN:
+        increase_font_size(terminal);
+        break;
+    case HELWAN_ACTION_ZOOM_OUT:
+        decrease_font_size(terminal);
+        break;
+    case HELWAN_ACTION_ZOOM_RESET:
+        reset_font_size(terminal);
+        break;
+    case HELWAN_ACTION_COMMAND_PALETTE:
+        show_command_palette(window);
+        break;
+    case HELWAN_ACTION_NEW_TAB:
+        on_new_tab_button_clicked(NULL, window);
+        break;
+    case HELWAN_ACTION_PREFERENCES:
+        create_preferences_dialog(window);
+        break;
+    case HELWAN_ACTION_NEXT_TAB:
+        switch_tab(window, 1);
+        break;
+    case HELWAN_ACTION_PREVIOUS_TAB:
+        switch_tab(window, -1);
+        break;
+    default:
+        return FALSE;
     }
 
-    return FALSE;
+    return TRUE;
 }
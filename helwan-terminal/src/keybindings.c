@@ -0,0 +1,140 @@
+#include "terminal_window.h"
+#include <gtk/gtk.h>
+#include <gio/gio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// الموديفايرز التي تجعل الضغطة اختصاراً وليست كتابة عادية
+#define COMMAND_MODIFIERS (GDK_CONTROL_MASK | GDK_MOD1_MASK | GDK_SUPER_MASK | GDK_HYPER_MASK | GDK_META_MASK)
+
+// ربط كل إجراء بمفتاحه في helwan-terminal.gschema.xml
+typedef struct {
+    HelwanAction action;
+    const char *key;
+} KeybindingSetting;
+
+static const KeybindingSetting keybinding_settings[] = {
+    { HELWAN_ACTION_COPY,            "keybinding-copy" },
+    { HELWAN_ACTION_PASTE,           "keybinding-paste" },
+    { HELWAN_ACTION_ZOOM_IN,         "keybinding-zoom-in" },
+    { HELWAN_ACTION_ZOOM_OUT,        "keybinding-zoom-out" },
+    { HELWAN_ACTION_ZOOM_RESET,      "keybinding-zoom-reset" },
+    { HELWAN_ACTION_COMMAND_PALETTE, "keybinding-command-palette" },
+    { HELWAN_ACTION_NEW_TAB,         "keybinding-new-tab" },
+    { HELWAN_ACTION_PREFERENCES,     "keybinding-preferences" },
+    { HELWAN_ACTION_NEXT_TAB,        "keybinding-next-tab" },
+    { HELWAN_ACTION_PREVIOUS_TAB,    "keybinding-previous-tab" },
+};
+
+// جدول الاختصارات: المفتاح (modifiers << 32 | keyval) والقيمة HelwanAction
+static GHashTable *binding_table = NULL;
+static GdkModifierType default_mod_mask = 0;
+
+// لو مفيش اختصار بدون Ctrl/Alt/Super، الكتابة العادية تروح للـ PTY بدون بحث
+static gboolean has_plain_bindings = FALSE;
+
+static gint64 binding_key(guint keyval, GdkModifierType mods) {
+    return ((gint64)(mods & default_mod_mask) << 32) | gdk_keyval_to_lower(keyval);
+}
+
+// تحويل الاختصارات المكتوبة في GSettings إلى جدول بحث
+static void compile_keybindings(GSettings *source) {
+    GHashTable *table = g_hash_table_new_full(g_int64_hash, g_int64_equal, g_free, NULL);
+    gboolean plain = FALSE;
+
+    for (gsize i = 0; i < G_N_ELEMENTS(keybinding_settings); i++) {
+        gchar **accels = g_settings_get_strv(source, keybinding_settings[i].key);
+
+        for (gchar **accel = accels; *accel; accel++) {
+            guint keyval = 0;
+            GdkModifierType mods = 0;
+
+            // القائمة الفارغة أو النص الفارغ يعني تعطيل الاختصار
+            if (**accel == '\0') {
+                continue;
+            }
+
+            gtk_accelerator_parse(*accel, &keyval, &mods);
+            if (keyval == 0) {
+                g_warning("Invalid keybinding '%s' for %s.", *accel, keybinding_settings[i].key);
+                continue;
+            }
+
+            gint64 key = binding_key(keyval, mods);
+            if (g_hash_table_contains(table, &key)) {
+                g_warning("Keybinding '%s' for %s is already bound, ignoring it.",
+                          *accel, keybinding_settings[i].key);
+                continue;
+            }
+
+            gint64 *table_key = g_new(gint64, 1);
+            *table_key = key;
+            g_hash_table_insert(table, table_key, GINT_TO_POINTER(keybinding_settings[i].action));
+
+            if (!(mods & COMMAND_MODIFIERS)) {
+                plain = TRUE;
+            }
+        }
+
+        g_strfreev(accels);
+    }
+
+    if (binding_table) {
+        g_hash_table_unref(binding_table);
+    }
+    binding_table = table;
+    has_plain_bindings = plain;
+}
+
+// إعادة بناء الجدول فور تغيير أي اختصار بدون إعادة تشغيل البرنامج
+static void on_keybinding_setting_changed(GSettings *source, const gchar *key, gpointer user_data) {
+    (void)user_data;
+    if (g_str_has_prefix(key, "keybinding-")) {
+        compile_keybindings(source);
+    }
+}
+
+// تحميل الاختصارات مرة واحدة لكل البرنامج
+void helwan_keybindings_init(GSettings *source) {
+    if (binding_table || !source) {
+        return;
+    }
+
+    default_mod_mask = gtk_accelerator_get_default_mod_mask();
+
+    // GSettings لا يضمن إشارة changed إلا للمفاتيح المقروءة بعد ربط الإشارة
+    g_signal_connect(source, "changed", G_CALLBACK(on_keybinding_setting_changed), NULL);
+    compile_keybindings(source);
+}
+
+// البحث عن الإجراء المرتبط بالضغطة، HELWAN_ACTION_NONE لو غير مربوطة
+HelwanAction helwan_keybindings_lookup(const GdkEventKey *event) {
+    GdkModifierType state = event->state & default_mod_mask;
+
+    // المسار السريع: حرف عادي بدون موديفاير ولا يوجد اختصار بدون موديفاير
+    if (!binding_table || (!(state & COMMAND_MODIFIERS) && !has_plain_bindings)) {
+        return HELWAN_ACTION_NONE;
+    }
+
+    gint64 key = binding_key(event->keyval, state);
+    gpointer action = g_hash_table_lookup(binding_table, &key);
+    if (action) {
+        return GPOINTER_TO_INT(action);
+    }
+
+    // محاولة ثانية بعد حذف الموديفايرز المستهلكة لإنتاج الرمز،
+    // مثلاً Ctrl++ في لوحة US تصل كـ Ctrl+Shift+plus
+    guint keyval = 0;
+    GdkModifierType consumed = 0;
+    GdkKeymap *keymap = gdk_keymap_get_for_display(gdk_display_get_default());
+    if (gdk_keymap_translate_keyboard_state(keymap, event->hardware_keycode, event->state, event->group,
+                                            &keyval, NULL, NULL, &consumed)) {
+        key = binding_key(keyval, state & ~consumed);
+        action = g_hash_table_lookup(binding_table, &key);
+        if (action) {
+            return GPOINTER_TO_INT(action);
+        }
+    }
+
+    return HELWAN_ACTION_NONE;
+}
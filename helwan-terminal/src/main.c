@@ -1,14 +1,31 @@
 #include <gtk/gtk.h>
 #include "terminal_window.h"
 
-int main(int argc, char *argv[]) {
-    gtk_init(&argc, &argv);
+#define HELWAN_APPLICATION_ID "io.github.helwanlinux.HelwanTerminal"
+
+// كل تشغيل لـ helwan-terminal يصل هنا في العملية الأولى (single instance)،
+// فتكون كل النوافذ في عملية واحدة ويمكن سحب التبويبات بينها
+static gint on_command_line(GApplication *app, GApplicationCommandLine *command_line, gpointer user_data) {
+    (void)app;
+    (void)user_data;
 
     // مرر argv كما هي إلى الدالة، وتأكد أن منطق التحليل داخل create_terminal_window
-    GtkWidget *window = create_terminal_window(argc, argv);
+    gint argc = 0;
+    gchar **argv = g_application_command_line_get_arguments(command_line, &argc);
 
+    GtkWidget *window = create_terminal_window(argc, argv, g_application_command_line_get_cwd(command_line));
     gtk_widget_show_all(window);
-    gtk_main();
 
+    g_strfreev(argv);
     return 0;
 }
+
+int main(int argc, char *argv[]) {
+    GtkApplication *app = gtk_application_new(HELWAN_APPLICATION_ID, G_APPLICATION_HANDLES_COMMAND_LINE);
+    g_signal_connect(app, "command-line", G_CALLBACK(on_command_line), NULL);
+
+    int status = g_application_run(G_APPLICATION(app), argc, argv);
+    g_object_unref(app);
+
+    return status;
+}
@@ -21,6 +21,13 @@ static void on_paste_menu_item_activated(GtkMenuItem *menu_item, VteTerminal *te
     }
 }
 
+// Callback لنقل التبويب إلى نافذة جديدة من القائمة
+static void on_move_to_new_window_menu_item_activated(GtkMenuItem *menu_item, VteTerminal *terminal) {
+    (void)menu_item;
+    HelwanTerminalWindow *window = HELWAN_TERMINAL_WINDOW(gtk_widget_get_toplevel(GTK_WIDGET(terminal)));
+    helwan_terminal_window_detach_tab(window, GTK_WIDGET(terminal));
+}
+
 // Callback للتعامل مع ضغطات الماوس على الـ VTE
 gboolean on_terminal_button_press(GtkWidget *widget, GdkEventButton *event, VteTerminal *terminal) {
     (void)widget;
@@ -30,18 +37,28 @@ gboolean on_terminal_button_press(GtkWidget *widget, GdkEventButton *event, VteT
         GtkWidget *menu = gtk_menu_new();
         GtkWidget *copy_item = gtk_menu_item_new_with_label("Copy");
         GtkWidget *paste_item = gtk_menu_item_new_with_label("Paste");
+        GtkWidget *move_item = gtk_menu_item_new_with_label("Move Tab to New Window");
 
         g_signal_connect(copy_item, "activate", G_CALLBACK(on_copy_menu_item_activated), terminal);
         g_signal_connect(paste_item, "activate", G_CALLBACK(on_paste_menu_item_activated), terminal);
+        g_signal_connect(move_item, "activate", G_CALLBACK(on_move_to_new_window_menu_item_activated), terminal);
 
         gtk_menu_shell_append(GTK_MENU_SHELL(menu), copy_item);
         gtk_menu_shell_append(GTK_MENU_SHELL(menu), paste_item);
+        gtk_menu_shell_append(GTK_MENU_SHELL(menu), gtk_separator_menu_item_new());
+        gtk_menu_shell_append(GTK_MENU_SHELL(menu), move_item);
 
         // تعطيل زر النسخ لو مفيش تحديد
         if (!vte_terminal_get_has_selection(terminal)) {
             gtk_widget_set_sensitive(copy_item, FALSE);
         }
 
+        // تعطيل النقل لو ده التبويب الوحيد في النافذة
+        GtkWidget *notebook = gtk_widget_get_parent(GTK_WIDGET(terminal));
+        if (!GTK_IS_NOTEBOOK(notebook) || gtk_notebook_get_n_pages(GTK_NOTEBOOK(notebook)) < 2) {
+            gtk_widget_set_sensitive(move_item, FALSE);
+        }
+
         // تعطيل زر اللصق لو الكليب بورد فاضي
         GtkClipboard *clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
         gchar *clipboard_text = gtk_clipboard_wait_for_text(clipboard);
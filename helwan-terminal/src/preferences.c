@@ -71,9 +71,18 @@ static void on_apply_preferences_clicked(GtkButton *button, gpointer user_data)
         g_settings_set_double(settings, "opacity", new_opacity);
     }
 
-    HelwanTerminalWindow *window = HELWAN_TERMINAL_WINDOW(gtk_window_get_transient_for(GTK_WINDOW(dialog)));
-    if (window) {
-        // Apply font to all VTE instances
+    // الإعدادات مشتركة، فتُطبق على كل نوافذ البرنامج وليس نافذة الحوار فقط
+    GList *windows = gtk_application_get_windows(GTK_APPLICATION(g_application_get_default()));
+    for (GList *l = windows; l; l = l->next) {
+        if (!HELWAN_IS_TERMINAL_WINDOW(l->data)) {
+            continue;
+        }
+        HelwanTerminalWindow *window = HELWAN_TERMINAL_WINDOW(l->data);
+        if (!window->notebook) {
+            continue;
+        }
+
+        // Apply font to all VTE instances in this window
         gint n_pages = gtk_notebook_get_n_pages(GTK_NOTEBOOK(window->notebook));
         for (gint i = 0; i < n_pages; i++) {
             GtkWidget *vte_widget = gtk_notebook_get_nth_page(GTK_NOTEBOOK(window->notebook), i);
@@ -19,28 +19,35 @@ static void on_tab_close_button_clicked(GtkButton *button, gpointer user_data) {
 
     if (notebook && GTK_IS_NOTEBOOK(notebook)) {
         gint page_num = gtk_notebook_page_num(GTK_NOTEBOOK(notebook), vte_widget);
+        // النافذة تُغلق نفسها عند خلوها من التبويبات (page-removed)
         if (page_num != -1) {
             gtk_notebook_remove_page(GTK_NOTEBOOK(notebook), page_num);
         }
-
-        if (gtk_notebook_get_n_pages(GTK_NOTEBOOK(notebook)) == 0) {
-            gtk_main_quit();
-        }
     }
 }
 
+// إضافة صفحة إلى الـ notebook مع السماح بإعادة ترتيبها وسحبها لنافذة أخرى
+static gint attach_tab(HelwanTerminalWindow *self, GtkWidget *page, GtkWidget *tab_label) {
+    GtkNotebook *notebook = GTK_NOTEBOOK(self->notebook);
+    gint page_num = gtk_notebook_append_page(notebook, page, tab_label);
+    gtk_notebook_set_tab_reorderable(notebook, page, TRUE);
+    gtk_notebook_set_tab_detachable(notebook, page, TRUE);
+    return page_num;
+}
+
 // دالة لإنشاء تبويب جديد
 GtkWidget *helwan_terminal_window_new_tab(HelwanTerminalWindow *self, char * const *command_to_execute) {
     GtkWidget *vte = vte_terminal_new();
 
-    g_signal_connect(vte, "key-press-event", G_CALLBACK(on_terminal_key_press), self);
+    // النافذة تُستنتج من الـ toplevel عند كل ضغطة لأن التبويب قد يُنقل لنافذة أخرى
+    g_signal_connect(vte, "key-press-event", G_CALLBACK(on_terminal_key_press), NULL);
     g_signal_connect(vte, "button-press-event", G_CALLBACK(on_terminal_button_press), vte);
 
     if (command_to_execute != NULL && command_to_execute[0] != NULL) {
         // تشغيل الأمر الممرر
         vte_terminal_spawn_async(VTE_TERMINAL(vte),
                                  VTE_PTY_DEFAULT,
-                                 NULL,
+                                 self->working_directory,
                                  (char **)command_to_execute,
                                  NULL,
                                  G_SPAWN_SEARCH_PATH,
@@ -53,7 +60,7 @@ GtkWidget *helwan_terminal_window_new_tab(HelwanTerminalWindow *self, char * con
         gchar **envp = g_get_environ();
         vte_terminal_spawn_async(VTE_TERMINAL(vte),
                                  VTE_PTY_DEFAULT,
-                                 NULL,
+                                 self->working_directory,
                                  default_cmd,
                                  envp,
                                  G_SPAWN_SEARCH_PATH,
@@ -71,7 +78,7 @@ GtkWidget *helwan_terminal_window_new_tab(HelwanTerminalWindow *self, char * con
 
     g_signal_connect(close_button, "clicked", G_CALLBACK(on_tab_close_button_clicked), vte);
 
-    gtk_notebook_append_page(GTK_NOTEBOOK(self->notebook), vte, label_box);
+    attach_tab(self, vte, label_box);
     gtk_widget_show_all(label_box);
     gtk_widget_show(vte);
 
@@ -95,3 +102,36 @@ void on_new_tab_button_clicked(GtkButton *button, HelwanTerminalWindow *window)
     gtk_notebook_set_current_page(GTK_NOTEBOOK(window->notebook),
                                   gtk_notebook_get_n_pages(GTK_NOTEBOOK(window->notebook)) - 1);
 }
+
+// نقل تبويب لنافذة أخرى بنفس الـ VteTerminal: الـ PTY والعملية والـ scrollback
+// تبقى كما هي لأن الـ widget نفسه يُنقل ولا يُعاد إنشاؤه
+void helwan_terminal_window_move_tab(HelwanTerminalWindow *self, GtkWidget *page, HelwanTerminalWindow *target) {
+    GtkNotebook *source = GTK_NOTEBOOK(self->notebook);
+    if (self == target || gtk_notebook_page_num(source, page) == -1) {
+        return;
+    }
+
+    GtkWidget *tab_label = gtk_notebook_get_tab_label(source, page);
+
+    // مرجع مؤقت حتى لا يُدمر الـ widget بين إزالته وإضافته
+    g_object_ref(page);
+    g_object_ref(tab_label);
+
+    gtk_container_remove(GTK_CONTAINER(source), page);
+    gint page_num = attach_tab(target, page, tab_label);
+    gtk_notebook_set_current_page(GTK_NOTEBOOK(target->notebook), page_num);
+
+    g_object_unref(tab_label);
+    g_object_unref(page);
+
+    gtk_widget_grab_focus(page);
+}
+
+// فصل تبويب في نافذة جديدة
+HelwanTerminalWindow *helwan_terminal_window_detach_tab(HelwanTerminalWindow *self, GtkWidget *page) {
+    HelwanTerminalWindow *target = helwan_terminal_window_new();
+    helwan_terminal_window_move_tab(self, page, target);
+    gtk_widget_show_all(GTK_WIDGET(target));
+    gtk_window_present(GTK_WINDOW(target));
+    return target;
+}
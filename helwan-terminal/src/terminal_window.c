@@ -18,15 +18,68 @@ static void helwan_terminal_window_init(HelwanTerminalWindow *self) {
     (void)self;
 }
 
+// دالة finalize
+static void helwan_terminal_window_finalize(GObject *object) {
+    HelwanTerminalWindow *self = HELWAN_TERMINAL_WINDOW(object);
+    g_free(self->working_directory);
+    G_OBJECT_CLASS(helwan_terminal_window_parent_class)->finalize(object);
+}
+
 // دالة class_init
 static void helwan_terminal_window_class_init(HelwanTerminalWindowClass *klass) {
-    (void)klass;
+    G_OBJECT_CLASS(klass)->finalize = helwan_terminal_window_finalize;
+}
+
+// عند تدمير النافذة (GtkApplication ينهي البرنامج بعد إغلاق آخر نافذة)
+static void on_window_destroy(GtkWidget *widget, HelwanTerminalWindow *window) {
+    (void)widget;
+    window->notebook = NULL;
+}
+
+// إغلاق النافذة لو فضيت من التبويبات، بعد انتهاء عملية السحب أو الإغلاق الحالية
+static gboolean close_window_if_empty(gpointer user_data) {
+    HelwanTerminalWindow *window = HELWAN_TERMINAL_WINDOW(user_data);
+
+    if (window->notebook && gtk_notebook_get_n_pages(GTK_NOTEBOOK(window->notebook)) == 0) {
+        gtk_widget_destroy(GTK_WIDGET(window));
+    }
+
+    g_object_unref(window);
+    return G_SOURCE_REMOVE;
 }
 
-// إنشاء النافذة الرئيسية
-GtkWidget *create_terminal_window(gint argc, char * const *argv) {
+// عند إزالة تبويب (إغلاق أو نقل لنافذة أخرى)
+static void on_notebook_page_removed(GtkNotebook *notebook, GtkWidget *child, guint page_num, HelwanTerminalWindow *window) {
+    (void)child;
+    (void)page_num;
+
+    if (gtk_widget_in_destruction(GTK_WIDGET(window))) {
+        return;
+    }
+
+    if (gtk_notebook_get_n_pages(notebook) == 0) {
+        g_idle_add(close_window_if_empty, g_object_ref(window));
+    }
+}
+
+// عند إفلات تبويب مسحوب خارج أي نافذة: إنشاء نافذة جديدة تستقبله
+static GtkNotebook *on_notebook_create_window(GtkNotebook *notebook, GtkWidget *page, gint x, gint y, HelwanTerminalWindow *window) {
+    (void)notebook;
+    (void)page;
+    (void)window;
+
+    HelwanTerminalWindow *new_window = helwan_terminal_window_new();
+    gtk_window_move(GTK_WINDOW(new_window), x, y);
+    gtk_widget_show_all(GTK_WIDGET(new_window));
+
+    return GTK_NOTEBOOK(new_window->notebook);
+}
+
+// إنشاء نافذة فارغة بدون تبويبات (تُستخدم أيضاً لاستقبال التبويبات المنقولة)
+HelwanTerminalWindow *helwan_terminal_window_new(void) {
     if (!settings) {
         settings = g_settings_new("org.helwan_terminal.gschema");
+        helwan_keybindings_init(settings);
     }
 
     if (!cached_font_string) {
@@ -44,7 +97,9 @@ GtkWidget *create_terminal_window(gint argc, char * const *argv) {
     gint initial_window_width = g_settings_get_int(settings, "window-width");
     gint initial_window_height = g_settings_get_int(settings, "window-height");
 
+    // كل النوافذ تتبع نفس GtkApplication في نفس العملية، وهذا شرط لسحب التبويبات بينها
     HelwanTerminalWindow *window = g_object_new(helwan_terminal_window_get_type(),
+                                                "application", g_application_get_default(),
                                                 "title", "Helwan Terminal",
                                                 "default-width", initial_window_width,
                                                 "default-height", initial_window_height,
@@ -53,7 +108,7 @@ GtkWidget *create_terminal_window(gint argc, char * const *argv) {
     gtk_widget_set_app_paintable(GTK_WIDGET(window), TRUE);
     gtk_widget_set_opacity(GTK_WIDGET(window), initial_opacity);
 
-    g_signal_connect(window, "destroy", G_CALLBACK(gtk_main_quit), NULL);
+    g_signal_connect(window, "destroy", G_CALLBACK(on_window_destroy), window);
 
     // Header bar
     GtkWidget *header_bar = gtk_header_bar_new();
@@ -93,8 +148,21 @@ GtkWidget *create_terminal_window(gint argc, char * const *argv) {
     gtk_notebook_set_scrollable(GTK_NOTEBOOK(window->notebook), TRUE);
     gtk_notebook_set_tab_pos(GTK_NOTEBOOK(window->notebook), GTK_POS_TOP);
 
+    // نفس اسم المجموعة في كل النوافذ يسمح بسحب التبويبات بينها
+    gtk_notebook_set_group_name(GTK_NOTEBOOK(window->notebook), HELWAN_TAB_GROUP);
+    g_signal_connect(window->notebook, "page-removed", G_CALLBACK(on_notebook_page_removed), window);
+    g_signal_connect(window->notebook, "create-window", G_CALLBACK(on_notebook_create_window), window);
+
     gtk_box_pack_start(GTK_BOX(vbox), window->notebook, TRUE, TRUE, 0);
 
+    return window;
+}
+
+// إنشاء النافذة الرئيسية، working_directory هو مجلد الأمر الذي فتح النافذة
+GtkWidget *create_terminal_window(gint argc, char * const *argv, const char *working_directory) {
+    HelwanTerminalWindow *window = helwan_terminal_window_new();
+    window->working_directory = g_strdup(working_directory);
+
     // تشغيل تبويب أولي
     char **spawn_argv = NULL;
     if (argc > 2 && strcmp(argv[1], "-e") == 0) {
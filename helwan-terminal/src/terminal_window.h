@@ -10,15 +10,22 @@ G_DECLARE_FINAL_TYPE(HelwanTerminalWindow, helwan_terminal_window, HELWAN, TERMI
 struct _HelwanTerminalWindow {
     GtkWindow parent_instance;
     GtkWidget *notebook;
+    gchar *working_directory;
 };
 
 struct _HelwanTerminalWindowClass {
     GtkWindowClass parent_class;
 };
 
+// اسم مجموعة التبويبات المشتركة بين كل النوافذ (للسحب والإفلات)
+#define HELWAN_TAB_GROUP "helwan-terminal-tabs"
+
 // دوال عامة
-GtkWidget *create_terminal_window(gint argc, char * const *argv);
+HelwanTerminalWindow *helwan_terminal_window_new(void);
+GtkWidget *create_terminal_window(gint argc, char * const *argv, const char *working_directory);
 GtkWidget *helwan_terminal_window_new_tab(HelwanTerminalWindow *self, char * const *command_to_execute);
+void helwan_terminal_window_move_tab(HelwanTerminalWindow *self, GtkWidget *page, HelwanTerminalWindow *target);
+HelwanTerminalWindow *helwan_terminal_window_detach_tab(HelwanTerminalWindow *self, GtkWidget *page);
 
 // دوال الخطوط
 void apply_font_settings(VteTerminal *terminal, const char *font_family, double font_size);
@@ -26,8 +33,27 @@ void increase_font_size(VteTerminal *terminal);
 void decrease_font_size(VteTerminal *terminal);
 void reset_font_size(VteTerminal *terminal);
 
+// الإجراءات التي يمكن ربطها باختصار من GSettings (keybinding-*)
+typedef enum {
+    HELWAN_ACTION_NONE = 0,
+    HELWAN_ACTION_COPY,
+    HELWAN_ACTION_PASTE,
+    HELWAN_ACTION_ZOOM_IN,
+    HELWAN_ACTION_ZOOM_OUT,
+    HELWAN_ACTION_ZOOM_RESET,
+    HELWAN_ACTION_COMMAND_PALETTE,
+    HELWAN_ACTION_NEW_TAB,
+    HELWAN_ACTION_PREFERENCES,
+    HELWAN_ACTION_NEXT_TAB,
+    HELWAN_ACTION_PREVIOUS_TAB
+} HelwanAction;
+
+// دوال الاختصارات
+void helwan_keybindings_init(GSettings *source);
+HelwanAction helwan_keybindings_lookup(const GdkEventKey *event);
+
 // دوال الكيبورد
-gboolean on_terminal_key_press(GtkWidget *widget, GdkEventKey *event, HelwanTerminalWindow *window);
+gboolean on_terminal_key_press(GtkWidget *widget, GdkEventKey *event, gpointer user_data);
 
 // دوال الماوس
 gboolean on_terminal_button_press(GtkWidget *widget, GdkEventButton *event, VteTerminal *terminal);
@@ -39,6 +65,9 @@ void on_new_tab_button_clicked(GtkButton *button, HelwanTerminalWindow *window);
 void create_preferences_dialog(HelwanTerminalWindow *window);
 void on_preferences_button_clicked(GtkButton *button, HelwanTerminalWindow *window);
 
+// دوال لوحة الأوامر
+void show_command_palette(HelwanTerminalWindow *window);
+
 // دوال حول البرنامج
 void on_about_button_clicked(GtkButton *button, HelwanTerminalWindow *window);
 void on_help_button_clicked(GtkButton *button, HelwanTerminalWindow *window);
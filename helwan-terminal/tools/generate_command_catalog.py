@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# توليد فهرس الأوامر الثنائي من ملف أوامر التوزيعة
+#
+# يقرأ helwan-commands-<distro>.sh ويستخرج كل دالة تنفيذ (مثل helwan_install)
+# مع أسمائها بالإنجليزية والعربية والإسبانية والصينية، والوصف من تعليق
+# القسم، وأمر مدير الحزم الفعلي. الناتج ملف يُقرأ مباشرة بـ mmap من
+# command_palette.c لذلك يجب أن يطابق التخطيط هنا ما هو معرّف هناك.
+#
+# التخطيط (little-endian):
+#   header:  char magic[4] = "HWCC", uint32 version, uint32 n_entries, uint32 strings_offset
+#   entries: n_entries * uint32[7] = {name, en, ar, es, zh, description, call}
+#            كل قيمة إزاحة داخل جدول النصوص (0 = نص فارغ)
+#   strings: نصوص UTF-8 منتهية بـ NUL، وأول بايت فيها NUL
+
+import re
+import struct
+import sys
+
+MAGIC = b'HWCC'
+VERSION = 1
+FIELDS = ('name', 'en', 'ar', 'es', 'zh', 'description', 'call')
+
+FUNC_START = re.compile(r'^([^\s()]+)\(\)\s*\{\s*$')
+ALIAS_LINE = re.compile(r'^([^\s()]+)\(\)\s*\{\s*([^\s;]+)[^;]*;\s*\}\s*$')
+HEREDOC = re.compile(r"<<-?\s*'?(\w+)'?")
+SECTION_NUMBER = re.compile(r'^\d+(\.\d+)*\.?\s*')
+SKIP_WORDS = ('if ', 'then', 'else', 'elif ', 'fi', 'echo ', 'local ', 'return')
+
+
+def classify(alias):
+    for ch in alias:
+        if '؀' <= ch <= 'ۿ':
+            return 'ar'
+        if '一' <= ch <= '鿿':
+            return 'zh'
+    return None
+
+
+def pick_call(name, body):
+    plain = [line for line in body if '<<' not in line]
+    for line in plain:
+        if not line.startswith(SKIP_WORDS):
+            return line
+    # دوال مثل help و system لا تستدعي مدير الحزم، نعرض أول سطر أو اسم الدالة
+    return plain[0] if plain else name
+
+
+def parse(path):
+    with open(path, encoding='utf-8') as f:
+        lines = [l.rstrip('\n').lstrip('﻿') for l in f]
+
+    functions = {}
+    order = []
+    # آخر تعليق ظهر قبل سطر الكود الحالي، ويُستهلك عند أول دالة أو اسم مستعار
+    comment = ''
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        stripped = line.strip()
+
+        if stripped.startswith('#'):
+            text = stripped.lstrip('#').strip()
+            if text and not text.startswith('=') and not text.startswith('!'):
+                comment = SECTION_NUMBER.sub('', text)
+            i += 1
+            continue
+
+        alias = ALIAS_LINE.match(stripped)
+        if alias:
+            name, target = alias.groups()
+            if target in functions:
+                entry = functions[target]
+                lang = classify(name)
+                if lang is None:
+                    lang = 'en' if not entry['en'] else 'es'
+                if not entry[lang]:
+                    entry[lang] = name
+                # تعليق مجموعة الأسماء المستعارة أدق من عنوان القسم العام
+                if comment:
+                    entry['description'] = comment
+            comment = ''
+            i += 1
+            continue
+
+        start = FUNC_START.match(line)
+        if start:
+            name = start.group(1)
+            body = []
+            i += 1
+            while i < len(lines) and lines[i].rstrip() != '}':
+                inner = lines[i].strip()
+                heredoc = HEREDOC.search(inner)
+                if inner:
+                    body.append(inner)
+                if heredoc:
+                    terminator = heredoc.group(1)
+                    i += 1
+                    while i < len(lines) and lines[i].strip() != terminator:
+                        i += 1
+                i += 1
+            i += 1
+            if name not in functions:
+                order.append(name)
+            functions[name] = dict.fromkeys(FIELDS, '')
+            functions[name]['name'] = name
+            functions[name]['description'] = comment
+            functions[name]['call'] = pick_call(name, body)
+            comment = ''
+            continue
+
+        i += 1
+
+    # الدوال الداخلية التي لا يوجد لها أي اسم مستعار لا تظهر للمستخدم
+    return [functions[n] for n in order
+            if any(functions[n][lang] for lang in ('en', 'ar', 'es', 'zh'))]
+
+
+def build(entries):
+    pool = bytearray(b'\0')
+    offsets = {'': 0}
+
+    def intern(text):
+        if text not in offsets:
+            offsets[text] = len(pool)
+            pool.extend(text.encode('utf-8') + b'\0')
+        return offsets[text]
+
+    table = bytearray()
+    for entry in entries:
+        table += struct.pack('<7I', *(intern(entry[field]) for field in FIELDS))
+
+    header_size = 16
+    strings_offset = header_size + len(table)
+    header = MAGIC + struct.pack('<3I', VERSION, len(entries), strings_offset)
+    return bytes(header + table + pool)
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write('usage: %s <helwan-commands.sh> <output.catalog>\n' % argv[0])
+        return 1
+
+    entries = parse(argv[1])
+    if not entries:
+        sys.stderr.write('%s: no commands found\n' % argv[1])
+        return 1
+
+    with open(argv[2], 'wb') as f:
+        f.write(build(entries))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))